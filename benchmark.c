@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h> // 필요한 헤더파일 불러오기
+
+// 명령을 실행해서 걸린 시간과 최대 메모리(peak RSS)를 재고 결과를 JSON 한 줄로 출력
+
+double nowSeconds(){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int runOnce(char **command, double *seconds, long *peak_rss_kb){ // fork/exec 한 번, 자식의 stdout 은 버림, 종료 코드 반환
+    double start = nowSeconds();
+    pid_t pid = fork();
+    if (pid < 0)
+        return -1;
+    if (pid == 0){
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0)
+            dup2(null_fd, STDOUT_FILENO);
+        execvp(command[0], command);
+        _exit(127);
+    }
+
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) < 0)
+        return -1;
+    *seconds = nowSeconds() - start;
+    *peak_rss_kb = usage.ru_maxrss; // Linux 에서는 KB 단위
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+int main(int argc, char *argv[]){
+    const char *output_path = NULL, *tag = "";
+    int repeat = 3, i = 1;
+    for (; i + 1 < argc && argv[i][0] == '-'; i += 2){ // 선택 인자 처리
+        if (strcmp(argv[i], "-o") == 0)
+            output_path = argv[i+1];
+        else if (strcmp(argv[i], "-tag") == 0)
+            tag = argv[i+1];
+        else if (strcmp(argv[i], "-r") == 0)
+            repeat = atoi(argv[i+1]);
+    }
+    if (argc - i < 3){
+        printf("Usage: %s [-o results.jsonl] [-tag tag] [-r repeat] name ops command [args...]\n", argv[0]);
+        return 1;
+    }
+    if (repeat < 1)
+        repeat = 1;
+
+    const char *name = argv[i];
+    double ops = atof(argv[i+1]);
+    char **command = &argv[i+2];
+
+    double best = 0;
+    long peak_rss_kb = 0;
+    int exit_code = 0, runs = 0;
+    for (; runs < repeat; ++runs){ // 가장 빠른 실행 시간과 가장 큰 RSS 를 기록, 실패하면 멈춤
+        double seconds;
+        long rss;
+        exit_code = runOnce(command, &seconds, &rss);
+        if (exit_code != 0)
+            break;
+        if (runs == 0 || seconds < best)
+            best = seconds;
+        if (rss > peak_rss_kb)
+            peak_rss_kb = rss;
+    }
+
+    char line[1024];
+    if (exit_code != 0) // 실패한 측정은 시간 항목 없이 기록해서 실제 측정값과 섞이지 않게 함
+        snprintf(line, sizeof(line),
+            "{\"name\":\"%s\",\"tag\":\"%s\",\"timestamp\":%ld,\"ops\":%.0f,\"runs\":%d,\"exit\":%d}\n",
+            name, tag, (long) time(NULL), ops, runs, exit_code);
+    else
+        snprintf(line, sizeof(line),
+            "{\"name\":\"%s\",\"tag\":\"%s\",\"timestamp\":%ld,\"ops\":%.0f,\"seconds\":%.6f,\"ops_per_sec\":%.1f,\"ns_per_op\":%.2f,\"peak_rss_kb\":%ld,\"runs\":%d,\"exit\":%d}\n",
+            name, tag, (long) time(NULL), ops, best, best > 0 ? ops / best : 0, ops > 0 ? best * 1e9 / ops : 0, peak_rss_kb, runs, exit_code);
+    fputs(line, stdout);
+
+    if (output_path != NULL){
+        FILE *ptr_output = fopen(output_path, "a");
+        if (ptr_output == NULL){
+            printf("Error opening files.\n");
+            return 1;
+        }
+        fputs(line, ptr_output);
+        fclose(ptr_output);
+    }
+    return exit_code;
+}
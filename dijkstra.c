@@ -1,6 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <limits.h> // 필요한 헤더파일 불러오기
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "server.h" // 필요한 헤더파일 불러오기
 
 #define INF INT_MAX
 #define NIL -1
@@ -16,9 +25,13 @@ typedef struct{
     int capacity;
     int *pos;
     MinHeapNode **array;
+    long long extractions;     // 이하 계측용 카운터
+    long long decrease_keys;
+    long long sift_down_levels; // minHeapify 에서 내려간 단계 수
+    long long sift_up_levels;   // decreaseKey 에서 올라간 단계 수
 } MinHeap;
 
-typedef struct{
+typedef struct AdjListNode{
     int vertex;
     int weight;
     struct AdjListNode* next;
@@ -29,7 +42,23 @@ typedef struct{
     int num_edges;
     int source;
     AdjListNode** adjList;
-} Graph; // 각 구조체 선언
+    AdjListNode* pool; // 파일에서 읽은 간선 노드를 한 번에 할당한 배열 (addEdge 로 추가된 노드는 개별 malloc)
+    int pool_size;
+} Graph;
+
+typedef struct{
+    long long pushes;
+    long long extractions;
+    long long decrease_keys;
+    long long sift_down_levels;
+    long long sift_up_levels;
+    long long relax_attempts;  // 검사한 간선 수
+    long long relax_success;   // dist 가 줄어든 간선 수
+    double load_seconds;
+    double init_seconds;
+    double search_seconds;
+    double output_seconds;
+} DijkstraStats; // 각 구조체 선언
 
 AdjListNode* newAdjListNode(int vertex, int weight){ // 새로운 인접 ListNode를 생성하고 초기화, 시간복잡도 = O(1)
     AdjListNode* node = (AdjListNode*) malloc(sizeof(AdjListNode));
@@ -48,6 +77,8 @@ Graph* createGraph(int num_vertices, int num_edges, int source){ // 그래프 
     for (int i = 0; i < num_vertices; ++i){
         graph->adjList[i] = NULL;
     }
+    graph->pool = NULL;
+    graph->pool_size = 0;
     return graph;
 }
 
@@ -57,8 +88,291 @@ void addEdge(Graph* graph, int src, int dest, int weight){ // addEdge 함수, 
     graph->adjList[src] = node;
 }
 
-MinHeapNode* newMinHeapNode(int vertex, int dist){ // 새로운 HeapNode 생성하고 초기화, 시간복잡도 = O(1)
-    MinHeapNode* minHeapNode = (MinHeapNode*) malloc(sizeof(MinHeapNode));
+void freeGraph(Graph* graph){ // 그래프 해제, pool 밖의 노드(addEdge 로 추가된 노드)만 개별 해제, 시간복잡도 = O(V+E)
+    for (int i = 0; i < graph->num_vertices; ++i){
+        AdjListNode* pCrawl = graph->adjList[i];
+        while (pCrawl){
+            AdjListNode* temp = pCrawl;
+            pCrawl = pCrawl->next;
+            if (graph->pool == NULL || temp < graph->pool || temp >= graph->pool + graph->pool_size)
+                free(temp);
+        }
+    }
+    free(graph->pool);
+    free(graph->adjList);
+    free(graph);
+}
+
+void linkPool(Graph* graph, const int* offset){ // pool[offset[u]..offset[u+1]) 을 정점 u 의 인접 리스트로 연결, 시간복잡도 = O(V+E)
+    for (int u = 0; u < graph->num_vertices; ++u){
+        graph->adjList[u] = offset[u] < offset[u+1] ? &graph->pool[offset[u]] : NULL;
+        for (int k = offset[u]; k < offset[u+1]; ++k)
+            graph->pool[k].next = k + 1 < offset[u+1] ? &graph->pool[k+1] : NULL;
+    }
+}
+
+typedef struct{
+    int src;
+    int dest;
+    int weight;
+} Edge;
+
+Graph* buildGraph(int num_vertices, int num_edges, int source, const Edge* edges){ // 간선 배열로 그래프 생성, 노드는 pool 한 번에 할당, 시간복잡도 = O(V+E)
+    if (num_vertices <= 0 || source < 0 || source >= num_vertices){
+        printf("Invalid source: %d (vertices: %d)\n", source, num_vertices);
+        return NULL;
+    }
+    Graph* graph = createGraph(num_vertices, num_edges, source);
+    int* offset = (int*) calloc(num_vertices + 1, sizeof(int));
+    int* fill = (int*) malloc((num_vertices + 1) * sizeof(int));
+
+    for (int i = 0; i < num_edges; ++i){
+        if (edges[i].src < 0 || edges[i].src >= num_vertices || edges[i].dest < 0 || edges[i].dest >= num_vertices){
+            printf("Invalid edge: %d\t%d\t%d\n", edges[i].src, edges[i].dest, edges[i].weight);
+            free(offset);
+            free(fill);
+            freeGraph(graph);
+            return NULL;
+        }
+        offset[edges[i].src + 1]++;
+    }
+    for (int u = 0; u < num_vertices; ++u)
+        offset[u+1] += offset[u];
+    memcpy(fill, offset, (num_vertices + 1) * sizeof(int));
+
+    graph->pool = (AdjListNode*) malloc((num_edges > 0 ? num_edges : 1) * sizeof(AdjListNode));
+    graph->pool_size = num_edges;
+    for (int i = 0; i < num_edges; ++i){ // 정점별 구간을 뒤에서부터 채워서 addEdge 와 같은 순서(입력의 역순)를 유지
+        AdjListNode* node = &graph->pool[--fill[edges[i].src + 1]];
+        node->vertex = edges[i].dest;
+        node->weight = edges[i].weight;
+    }
+    linkPool(graph, offset);
+
+    free(offset);
+    free(fill);
+    return graph;
+}
+
+const char* parseInt(const char* p, const char* end, int* out){ // 숫자가 아닌 문자는 건너뛰고 정수 하나를 읽음, 더 없으면 NULL
+    while (p < end && (*p < '0' || *p > '9') && *p != '-')
+        p++;
+    if (p == end)
+        return NULL;
+
+    int negative = 0;
+    if (*p == '-'){
+        negative = 1;
+        p++;
+    }
+    int value = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+        value = value * 10 + (*p++ - '0');
+    *out = negative ? -value : value;
+    return p;
+}
+
+typedef struct{
+    const char* begin; // 줄 단위로 나뉜 입력 구간
+    const char* end;
+    Edge* edges;       // 구간 크기로 잡은 상한만큼 할당, 간선 한 줄은 최소 6바이트
+    int count;
+} ParseChunk;
+
+void* parseWorker(void* arg){ // 구간 하나의 "src\tdest\tweight" 줄들을 간선 배열로 변환
+    ParseChunk* chunk = (ParseChunk*) arg;
+    const char* p = chunk->begin;
+    Edge e;
+    chunk->count = 0;
+    while ((p = parseInt(p, chunk->end, &e.src)) != NULL
+        && (p = parseInt(p, chunk->end, &e.dest)) != NULL
+        && (p = parseInt(p, chunk->end, &e.weight)) != NULL){
+        chunk->edges[chunk->count++] = e;
+    }
+    return NULL;
+}
+
+Graph* loadGraphText(const char* data, size_t length, int num_threads){ // mmap 한 텍스트 입력을 num_threads 개 구간으로 나눠 병렬 파싱, 시간복잡도 = O(파일 크기 / num_threads + V + E)
+    const char* end = data + length;
+    int num_vertices, num_edges, source;
+    const char* p = data;
+    if ((p = parseInt(p, end, &num_vertices)) == NULL || (p = parseInt(p, end, &num_edges)) == NULL || (p = parseInt(p, end, &source)) == NULL)
+        return NULL;
+
+    size_t body = end - p;
+    if (num_threads < 1 || body < (size_t) num_threads * 4096)
+        num_threads = 1; // 작은 입력은 스레드 생성 비용이 더 큼
+
+    ParseChunk* chunks = (ParseChunk*) malloc(num_threads * sizeof(ParseChunk));
+    pthread_t* threads = (pthread_t*) malloc(num_threads * sizeof(pthread_t));
+    for (int t = 0; t < num_threads; ++t){ // 구간 경계는 다음 줄의 시작으로 맞춤
+        const char* begin = t == 0 ? p : p + body / num_threads * t;
+        if (t > 0){
+            while (begin < end && begin[-1] != '\n')
+                begin++;
+        }
+        chunks[t].begin = begin;
+        if (t > 0)
+            chunks[t-1].end = begin;
+    }
+    chunks[num_threads-1].end = end;
+
+    for (int t = 0; t < num_threads; ++t){
+        chunks[t].edges = (Edge*) malloc(((chunks[t].end - chunks[t].begin) / 6 + 1) * sizeof(Edge));
+        pthread_create(&threads[t], NULL, parseWorker, &chunks[t]);
+    }
+    int parsed = 0;
+    for (int t = 0; t < num_threads; ++t){
+        pthread_join(threads[t], NULL);
+        parsed += chunks[t].count;
+    }
+
+    Edge* edges = chunks[0].edges; // 구간별 결과를 입력 순서대로 이어붙임
+    if (num_threads > 1){
+        edges = (Edge*) malloc((parsed > 0 ? parsed : 1) * sizeof(Edge));
+        for (int t = 0, k = 0; t < num_threads; k += chunks[t].count, ++t){
+            memcpy(edges + k, chunks[t].edges, chunks[t].count * sizeof(Edge));
+            free(chunks[t].edges);
+        }
+    }
+    if (parsed > num_edges)
+        parsed = num_edges; // 헤더의 간선 수까지만 사용
+
+    Graph* graph = NULL;
+    if (parsed < num_edges) // 잘린 입력을 일부만 읽은 채로 진행하지 않음
+        printf("Truncated input: %d of %d edges\n", parsed, num_edges);
+    else
+        graph = buildGraph(num_vertices, parsed, source, edges);
+    free(edges);
+    free(chunks);
+    free(threads);
+    return graph;
+}
+
+#define GRAPH_MAGIC 0x4B4A4447 // "GDJK", 바이너리 그래프 파일 식별자
+
+typedef struct{
+    int magic;
+    int num_vertices;
+    int num_edges;
+    int source;
+} GraphFileHeader; // 뒤에 offset[V+1], 이어서 정점별 (vertex, weight) 쌍이 인접 리스트 순서대로 저장됨
+
+int saveGraphBinary(Graph* graph, const char* path){ // 파싱 없이 다시 읽을 수 있는 바이너리 그래프 파일 저장, 시간복잡도 = O(V+E)
+    FILE* ptr_file = fopen(path, "wb");
+    if (ptr_file == NULL)
+        return -1;
+
+    int* offset = (int*) malloc((graph->num_vertices + 1) * sizeof(int));
+    int* pairs = (int*) malloc(2 * (graph->num_edges > 0 ? graph->num_edges : 1) * sizeof(int));
+    int k = 0;
+    for (int u = 0; u < graph->num_vertices; ++u){
+        offset[u] = k;
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next){
+            pairs[2*k] = pCrawl->vertex;
+            pairs[2*k+1] = pCrawl->weight;
+            k++;
+        }
+    }
+    offset[graph->num_vertices] = k;
+
+    GraphFileHeader header = { GRAPH_MAGIC, graph->num_vertices, k, graph->source };
+    fwrite(&header, sizeof(header), 1, ptr_file);
+    fwrite(offset, sizeof(int), graph->num_vertices + 1, ptr_file);
+    fwrite(pairs, sizeof(int), 2 * (size_t) k, ptr_file);
+
+    free(offset);
+    free(pairs);
+    return fclose(ptr_file) == 0 ? 0 : -1;
+}
+
+Graph* loadGraphBinary(const char* data, size_t length){ // mmap 한 바이너리 그래프 파일에서 pool 을 바로 채움, 시간복잡도 = O(V+E)
+    const GraphFileHeader* header = (const GraphFileHeader*) data;
+    if (length < sizeof(GraphFileHeader) || header->magic != GRAPH_MAGIC)
+        return NULL;
+    const int* offset = (const int*) (header + 1);
+    const int* pairs = offset + header->num_vertices + 1;
+    if (header->num_vertices <= 0 || header->num_edges < 0 || header->source < 0 || header->source >= header->num_vertices
+        || length < sizeof(GraphFileHeader) + ((size_t) header->num_vertices + 1 + 2 * (size_t) header->num_edges) * sizeof(int))
+        return NULL;
+
+    if (offset[0] != 0 || offset[header->num_vertices] != header->num_edges) // offset 은 0 에서 시작해 num_edges 로 끝나고 줄어들지 않아야 함
+        return NULL;
+    for (int u = 0; u < header->num_vertices; ++u)
+        if (offset[u] > offset[u+1])
+            return NULL;
+
+    Graph* graph = createGraph(header->num_vertices, header->num_edges, header->source);
+    graph->pool = (AdjListNode*) malloc((header->num_edges > 0 ? header->num_edges : 1) * sizeof(AdjListNode));
+    graph->pool_size = header->num_edges;
+    for (int k = 0; k < header->num_edges; ++k){
+        if (pairs[2*k] < 0 || pairs[2*k] >= header->num_vertices){ // 손상되었거나 오래된 파일
+            freeGraph(graph);
+            return NULL;
+        }
+        graph->pool[k].vertex = pairs[2*k];
+        graph->pool[k].weight = pairs[2*k+1];
+    }
+    linkPool(graph, offset);
+    return graph;
+}
+
+Graph* loadGraph(const char* path, int num_threads){ // 파일을 mmap 하고 앞 4바이트로 바이너리/텍스트 구분
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0){
+        close(fd);
+        return NULL;
+    }
+
+    const char* data = (const char*) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+    madvise((void*) data, st.st_size, MADV_SEQUENTIAL);
+
+    Graph* graph;
+    if ((size_t) st.st_size >= sizeof(int) && *(const int*) data == GRAPH_MAGIC){
+        graph = loadGraphBinary(data, st.st_size);
+        if (graph == NULL)
+            printf("Invalid graph file: %s\n", path);
+    } else
+        graph = loadGraphText(data, st.st_size, num_threads);
+
+    munmap((void*) data, st.st_size);
+    return graph;
+}
+
+Graph* loadGraphScanf(FILE* ptr_input){ // 기존 방식: 간선마다 fscanf + addEdge (비교용)
+    int num_vertices, num_edges, source;
+    if (fscanf(ptr_input, "%d\t%d\t%d", &num_vertices, &num_edges, &source) != 3)
+        return NULL;
+    if (num_vertices <= 0 || source < 0 || source >= num_vertices){
+        printf("Invalid source: %d (vertices: %d)\n", source, num_vertices);
+        return NULL;
+    }
+
+    Graph* graph = createGraph(num_vertices, num_edges, source);
+    for (int i = 0; i < num_edges; ++i){
+        int src, dest, weight;
+        if (fscanf(ptr_input, "%d\t%d\t%d", &src, &dest, &weight) != 3){
+            printf("Truncated input: %d of %d edges\n", i, num_edges);
+            freeGraph(graph);
+            return NULL;
+        }
+        if (src < 0 || src >= num_vertices || dest < 0 || dest >= num_vertices){
+            printf("Invalid edge: %d\t%d\t%d\n", src, dest, weight);
+            freeGraph(graph);
+            return NULL;
+        }
+        addEdge(graph, src, dest, weight);
+    }
+    return graph;
+}
+
+MinHeapNode* newMinHeapNode(MinHeapNode* minHeapNode, int vertex, int dist){ // 미리 할당한 자리에 HeapNode 초기화, 시간복잡도 = O(1)
     minHeapNode->vertex = vertex;
     minHeapNode->dist = dist;
     minHeapNode->pred = NIL;
@@ -71,6 +385,10 @@ MinHeap* createMinHeap(int capacity){ // minHeap을 생성하고 초기화, 시
     minHeap->size = 0;
     minHeap->capacity = capacity;
     minHeap->array = (MinHeapNode**) malloc(capacity * sizeof(MinHeapNode*));
+    minHeap->extractions = 0;
+    minHeap->decrease_keys = 0;
+    minHeap->sift_down_levels = 0;
+    minHeap->sift_up_levels = 0;
     return minHeap;
 }
 
@@ -99,6 +417,7 @@ void minHeapify(MinHeap* minHeap, int idx){ // 문제조건 minHeapify 함수, 
         minHeap->pos[idxNode->vertex] = smallest;
 
         swapMinHeapNode(&minHeap->array[smallest], &minHeap->array[idx]);
+        minHeap->sift_down_levels++;
 
         minHeapify(minHeap, smallest);
     }
@@ -120,6 +439,7 @@ MinHeapNode* extractMin(MinHeap* minHeap){ // 문제조건 extractMin 함수, 
     minHeap->pos[lastNode->vertex] = 0;
 
     --minHeap->size;
+    minHeap->extractions++;
     minHeapify(minHeap, 0);
 
     return root;
@@ -129,37 +449,47 @@ void decreaseKey(MinHeap* minHeap, int vertex, int dist, int pred){ // 문제조
     int i = minHeap->pos[vertex];
     minHeap->array[i]->dist = dist;
     minHeap->array[i]->pred = pred;
+    minHeap->decrease_keys++;
 
     while (i && minHeap->array[i]->dist < minHeap->array[(i-1)/2]->dist){
         minHeap->pos[minHeap->array[i]->vertex] = (i - 1) / 2;
         minHeap->pos[minHeap->array[(i-1)/2]->vertex] = i;
         swapMinHeapNode(&minHeap->array[i], &minHeap->array[(i-1)/2]);
+        minHeap->sift_up_levels++;
 
         i = (i-1)/2;
     }
 } // 키 값을 감소시킨 후, 이를 적절한 위치에 배치하기 위해 힙 구조를 재조정하는 과정
 
-void dijkstra(Graph* graph){ // 위의 함수를 바탕으로 구현되는 다익스트라 알고리즘, 시간복잡도 O((V+E)logV)
+double elapsedSince(struct timespec* start){
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+void dijkstra(Graph* graph, int* dist, int* pred, DijkstraStats* stats){ // 위의 함수를 바탕으로 구현되는 다익스트라 알고리즘, 결과는 dist/pred 에 저장, 시간복잡도 O((V+E)logV)
     int num_vertices = graph->num_vertices;
     int src = graph->source;
+    struct timespec start;
 
-    int* dist = (int*) malloc(num_vertices * sizeof(int));
-    int* pred = (int*) malloc(num_vertices * sizeof(int));
+    clock_gettime(CLOCK_MONOTONIC, &start);
     MinHeap* minHeap = createMinHeap(num_vertices);
+    MinHeapNode* nodes = (MinHeapNode*) malloc(num_vertices * sizeof(MinHeapNode)); // 노드마다 malloc 하지 않고 한 번에 할당
 
     for (int v = 0; v < num_vertices; ++v){ // Insertion() 문제조건 관련 반영 부분
         dist[v] = INF;
         pred[v] = NIL;
-        minHeap->array[v] = newMinHeapNode(v, dist[v]);
+        minHeap->array[v] = newMinHeapNode(&nodes[v], v, dist[v]);
         minHeap->pos[v] = v;
     }
 
-    minHeap->array[src] = newMinHeapNode(src, dist[src]);
-    minHeap->pos[src] = src;
     dist[src] = 0;
     decreaseKey(minHeap, src, dist[src], NIL);
     minHeap->size = num_vertices;
+    stats->init_seconds = elapsedSince(&start);
 
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    long long relax_attempts = 0, relax_success = 0;
     while (!isEmpty(minHeap)){
         MinHeapNode* minHeapNode = extractMin(minHeap);
         int u = minHeapNode->vertex;
@@ -168,72 +498,755 @@ void dijkstra(Graph* graph){ // 위의 함수를 바탕으로 구현되는 다
         while (pCrawl != NULL){
             int v = pCrawl->vertex;
 
+            relax_attempts++;
             if (minHeap->pos[v] < minHeap->size && dist[u] != INF && pCrawl->weight + dist[u] < dist[v]) {
                 dist[v] = dist[u] + pCrawl->weight;
                 pred[v] = u;
                 decreaseKey(minHeap, v, dist[v], u);
+                relax_success++;
             }
             pCrawl = pCrawl->next;
         }
     }
+    stats->search_seconds = elapsedSince(&start);
+
+    stats->pushes = num_vertices;
+    stats->extractions = minHeap->extractions;
+    stats->decrease_keys = minHeap->decrease_keys;
+    stats->sift_down_levels = minHeap->sift_down_levels;
+    stats->sift_up_levels = minHeap->sift_up_levels;
+    stats->relax_attempts = relax_attempts;
+    stats->relax_success = relax_success;
 
-    FILE *ptr_output = fopen("output.txt", "w");
+    free(nodes);
+    free(minHeap->pos);
+    free(minHeap->array);
+    free(minHeap);
+}
+
+#define OUTPUT_BUFFER (1 << 20) // 결과 출력 버퍼 크기
+
+typedef struct{
+    FILE* file;
+    char* data;
+    size_t length;
+} OutputBuffer; // fprintf 대신 정수를 직접 변환해서 모아 두었다가 큰 단위로 fwrite
+
+OutputBuffer* createOutputBuffer(FILE* file){
+    OutputBuffer* out = (OutputBuffer*) malloc(sizeof(OutputBuffer));
+    out->file = file;
+    out->data = (char*) malloc(OUTPUT_BUFFER);
+    out->length = 0;
+    return out;
+}
+
+void flushOutput(OutputBuffer* out){
+    fwrite(out->data, 1, out->length, out->file);
+    out->length = 0;
+}
+
+void freeOutputBuffer(OutputBuffer* out){ // 남은 내용을 쓰고 해제
+    flushOutput(out);
+    free(out->data);
+    free(out);
+}
+
+void reserveOutput(OutputBuffer* out, size_t n){ // 한 줄을 쓰기 전에 공간 확보 (n < OUTPUT_BUFFER)
+    if (out->length + n > OUTPUT_BUFFER)
+        flushOutput(out);
+}
+
+void putInt(OutputBuffer* out, int value){ // 정수 하나를 10진수로 변환, 시간복잡도 O(자릿수)
+    char digits[12];
+    int n = 0;
+    unsigned int u = value < 0 ? 0u - (unsigned int) value : (unsigned int) value;
+    do {
+        digits[n++] = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    if (value < 0)
+        out->data[out->length++] = '-';
+    while (n > 0)
+        out->data[out->length++] = digits[--n];
+}
+
+void putText(OutputBuffer* out, const char* text){
+    while (*text)
+        out->data[out->length++] = *text++;
+}
+
+void writeResult(FILE* ptr_output, int* dist, int* pred, int num_vertices, int src){ // "정점\t거리\t이전 정점" 형식으로 결과 출력, source 의 이전 정점은 NIL
+    OutputBuffer* out = createOutputBuffer(ptr_output);
     for (int i = 0; i < num_vertices; ++i){
+        reserveOutput(out, 40);
+        putInt(out, i);
+        putText(out, "\t");
+        putInt(out, dist[i]);
+        putText(out, "\t");
         if (i == src)
-            fprintf(ptr_output, "%d\t%d\tNIL\n", i, dist[i]);
+            putText(out, "NIL");
         else
-            fprintf(ptr_output, "%d\t%d\t%d\n", i, dist[i], pred[i]);
+            putInt(out, pred[i]);
+        putText(out, "\n");
     }
-    fclose(ptr_output);
+    freeOutputBuffer(out);
+}
 
-    free(minHeap->pos);
-    free(minHeap->array);
-    free(minHeap);
-    free(dist);
-    free(pred);
+#define RESULT_MAGIC 0x524A4447 // "GDJR", 바이너리 결과 파일 식별자
+
+int writeResultBinary(const char* path, int* dist, int* pred, int num_vertices, int src){ // 헤더 (magic, V, source) 뒤에 dist[V], pred[V] 를 그대로 저장
+    FILE* ptr_file = fopen(path, "wb");
+    if (ptr_file == NULL)
+        return -1;
+    int header[3] = { RESULT_MAGIC, num_vertices, src };
+    fwrite(header, sizeof(int), 3, ptr_file);
+    fwrite(dist, sizeof(int), num_vertices, ptr_file);
+    fwrite(pred, sizeof(int), num_vertices, ptr_file);
+    return fclose(ptr_file) == 0 ? 0 : -1;
+}
+
+int writeReport(const char* path, Graph* graph, DijkstraStats* stats){ // 계측 결과를 JSON 으로 저장
+    FILE* ptr_file = fopen(path, "w");
+    if (ptr_file == NULL)
+        return -1;
+    fprintf(ptr_file, "{\n");
+    fprintf(ptr_file, "  \"vertices\": %d,\n  \"edges\": %d,\n  \"source\": %d,\n", graph->num_vertices, graph->num_edges, graph->source);
+    fprintf(ptr_file, "  \"heap\": {\"pushes\": %lld, \"extractions\": %lld, \"decrease_keys\": %lld, \"sift_down_levels\": %lld, \"sift_up_levels\": %lld},\n",
+        stats->pushes, stats->extractions, stats->decrease_keys, stats->sift_down_levels, stats->sift_up_levels);
+    fprintf(ptr_file, "  \"relaxations\": {\"attempted\": %lld, \"successful\": %lld},\n", stats->relax_attempts, stats->relax_success);
+    fprintf(ptr_file, "  \"seconds\": {\"load\": %.6f, \"init\": %.6f, \"search\": %.6f, \"output\": %.6f}\n",
+        stats->load_seconds, stats->init_seconds, stats->search_seconds, stats->output_seconds);
+    fprintf(ptr_file, "}\n");
+    return fclose(ptr_file) == 0 ? 0 : -1;
+}
+
+typedef struct{ // 여러 질의에 재사용되는 스레드별 작업공간
+    int num_vertices;
+    unsigned int version; // 현재 질의 번호
+    unsigned int *stamp;  // stamp[v] != version 이면 이번 질의에서 아직 건드리지 않은 정점 (dist = INF)
+    int *dist;
+    int *pred;
+    int *pos;             // 힙 안에서의 위치, 확정된 정점은 NIL
+    int *heap;            // 정점 번호만 저장하는 이진 힙, 건드린 정점만 들어감
+    int size;
+    int last;             // 마지막으로 확정된 정점
+} Workspace;
+
+typedef struct{
+    int source;
+    int target;  // NIL 이면 source 에서 도달 가능한 모든 정점을 탐색
+    int dist;    // target 까지의 거리, target 이 NIL 이면 가장 먼 정점까지의 거리
+    int reached; // 확정된 정점 수
+} Query;
+
+Workspace* createWorkspace(int num_vertices){ // 작업공간 생성, 스레드당 한 번만 수행, 시간복잡도 = O(num_vertices)
+    Workspace* ws = (Workspace*) malloc(sizeof(Workspace));
+    ws->num_vertices = num_vertices;
+    ws->version = 0;
+    ws->stamp = (unsigned int*) calloc(num_vertices, sizeof(unsigned int));
+    ws->dist = (int*) malloc(num_vertices * sizeof(int));
+    ws->pred = (int*) malloc(num_vertices * sizeof(int));
+    ws->pos = (int*) malloc(num_vertices * sizeof(int));
+    ws->heap = (int*) malloc(num_vertices * sizeof(int));
+    ws->size = 0;
+    return ws;
+}
+
+void freeWorkspace(Workspace* ws){
+    free(ws->stamp);
+    free(ws->dist);
+    free(ws->pred);
+    free(ws->pos);
+    free(ws->heap);
+    free(ws);
+}
+
+void resetWorkspace(Workspace* ws){ // 질의 사이 초기화, version 만 올리므로 O(1) (overflow 시에만 O(num_vertices))
+    if (++ws->version == 0){
+        memset(ws->stamp, 0, ws->num_vertices * sizeof(unsigned int));
+        ws->version = 1;
+    }
+    ws->size = 0;
+}
+
+int wsDist(Workspace* ws, int v){ // 이번 질의에서 건드리지 않은 정점은 INF
+    return ws->stamp[v] == ws->version ? ws->dist[v] : INF;
+}
+
+void wsSiftUp(Workspace* ws, int i){ // decreaseKey 와 같은 방식의 상향 조정, 시간복잡도 O(log N)
+    int v = ws->heap[i];
+    while (i && ws->dist[ws->heap[(i-1)/2]] > ws->dist[v]){
+        ws->heap[i] = ws->heap[(i-1)/2];
+        ws->pos[ws->heap[i]] = i;
+        i = (i-1)/2;
+    }
+    ws->heap[i] = v;
+    ws->pos[v] = i;
+}
+
+void wsSiftDown(Workspace* ws, int i){ // minHeapify 와 같은 방식의 하향 조정, 시간복잡도 O(log N)
+    int v = ws->heap[i];
+    while (1){
+        int smallest = 2 * i + 1;
+        if (smallest >= ws->size)
+            break;
+        if (smallest + 1 < ws->size && ws->dist[ws->heap[smallest+1]] < ws->dist[ws->heap[smallest]])
+            smallest++;
+        if (ws->dist[ws->heap[smallest]] >= ws->dist[v])
+            break;
+        ws->heap[i] = ws->heap[smallest];
+        ws->pos[ws->heap[i]] = i;
+        i = smallest;
+    }
+    ws->heap[i] = v;
+    ws->pos[v] = i;
+}
+
+void wsRelax(Workspace* ws, int v, int dist, int pred){ // 처음 보는 정점은 힙에 삽입, 이미 힙에 있으면 decreaseKey
+    if (ws->stamp[v] != ws->version){
+        ws->stamp[v] = ws->version;
+        ws->dist[v] = dist;
+        ws->pred[v] = pred;
+        ws->heap[ws->size] = v;
+        wsSiftUp(ws, ws->size++);
+    } else if (ws->pos[v] != NIL && dist < ws->dist[v]){
+        ws->dist[v] = dist;
+        ws->pred[v] = pred;
+        wsSiftUp(ws, ws->pos[v]);
+    }
+}
+
+int wsExtractMin(Workspace* ws){ // 최소 정점을 꺼내고 확정 표시
+    int u = ws->heap[0];
+    ws->pos[u] = NIL;
+    if (--ws->size > 0){
+        ws->heap[0] = ws->heap[ws->size];
+        wsSiftDown(ws, 0);
+    }
+    return u;
+}
+
+int dijkstraQuery(Graph* graph, Workspace* ws, int src, int target){ // 작업공간을 재사용하는 단일 질의, 시간복잡도 O((V'+E')logV') (V', E' = 건드린 정점/간선)
+    int reached = 0;
+    resetWorkspace(ws);
+    wsRelax(ws, src, 0, NIL);
+
+    while (ws->size > 0){
+        int u = wsExtractMin(ws);
+        ws->last = u;
+        reached++;
+        if (u == target)
+            break; // 목적지가 확정되면 조기 종료
+
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next)
+            wsRelax(ws, pCrawl->vertex, ws->dist[u] + pCrawl->weight, u);
+    }
+    return reached;
+}
+
+typedef struct{
+    Graph* graph;
+    Query* queries;
+    int num_queries;
+    atomic_int* next; // 다음에 처리할 질의 번호 (스레드 간 공유)
+} BatchContext;
+
+#define BATCH_CHUNK 16 // 한 번에 가져가는 질의 수
+
+void* batchWorker(void* arg){ // 공유 카운터에서 질의를 가져가 처리하는 스레드, 그래프는 읽기 전용으로 공유
+    BatchContext* ctx = (BatchContext*) arg;
+    Workspace* ws = createWorkspace(ctx->graph->num_vertices);
+
+    while (1){
+        int begin = atomic_fetch_add(ctx->next, BATCH_CHUNK);
+        if (begin >= ctx->num_queries)
+            break;
+        int end = begin + BATCH_CHUNK < ctx->num_queries ? begin + BATCH_CHUNK : ctx->num_queries;
+
+        for (int i = begin; i < end; ++i){
+            Query* q = &ctx->queries[i];
+            q->reached = dijkstraQuery(ctx->graph, ws, q->source, q->target);
+            if (q->target != NIL)
+                q->dist = wsDist(ws, q->target);
+            else
+                q->dist = ws->dist[ws->last]; // 확정 순서상 마지막 정점이 가장 멀다
+        }
+    }
+
+    freeWorkspace(ws);
+    return NULL;
+}
+
+double dijkstraBatch(Graph* graph, Query* queries, int num_queries, int num_threads){ // 여러 source 에 대한 질의를 스레드 풀로 분배, 걸린 시간(초) 반환
+    atomic_int next = 0;
+    BatchContext ctx = { graph, queries, num_queries, &next };
+    pthread_t* threads = (pthread_t*) malloc(num_threads * sizeof(pthread_t));
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int t = 0; t < num_threads; ++t)
+        pthread_create(&threads[t], NULL, batchWorker, &ctx);
+    for (int t = 0; t < num_threads; ++t)
+        pthread_join(threads[t], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free(threads);
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+Query* readQueries(FILE* ptr_queries, int num_vertices, int* num_queries){ // 질의 파일 읽기, 한 줄에 "source" 또는 "source\ttarget", 범위 밖 정점은 건너뜀
+    int capacity = 1024, count = 0;
+    Query* queries = (Query*) malloc(capacity * sizeof(Query));
+    char line[64];
+
+    while (fgets(line, sizeof(line), ptr_queries) != NULL){
+        int source, target;
+        int n = sscanf(line, "%d\t%d", &source, &target);
+        if (n < 1)
+            continue;
+        if (source < 0 || source >= num_vertices || (n == 2 && (target < 0 || target >= num_vertices))){
+            printf("Invalid query: %s", line);
+            continue;
+        }
+        if (count == capacity){
+            capacity *= 2;
+            queries = (Query*) realloc(queries, capacity * sizeof(Query));
+        }
+        queries[count].source = source;
+        queries[count].target = n == 2 ? target : NIL;
+        count++;
+    }
+    *num_queries = count;
+    return queries;
+}
+
+typedef struct InEdge{ // 역방향 인접 리스트 노드, 가중치는 정방향 노드와 공유
+    int vertex;        // 간선의 출발 정점
+    AdjListNode* edge;
+    struct InEdge* next;
+} InEdge;
+
+typedef struct{ // 간선 변경 사이에 유지되는 최단경로 트리
+    Graph* graph;
+    int source;
+    int* dist;
+    int* pred;
+    InEdge** inList;
+    InEdge* inPool;    // 처음 만든 역방향 노드 배열 (이후 삽입된 간선은 개별 malloc)
+    int inPoolSize;
+    Workspace* ws;     // 복구 탐색용 힙, 이번 복구에서 건드린 정점만 들어감
+    unsigned int* mark;
+    unsigned int round; // mark[v] == round 이면 이번 복구에서 영향받은 정점
+    int* affected;
+} DynamicSSSP;
+
+void addInEdge(DynamicSSSP* ds, InEdge* in, int src, AdjListNode* edge){
+    in->vertex = src;
+    in->edge = edge;
+    in->next = ds->inList[edge->vertex];
+    ds->inList[edge->vertex] = in;
+}
+
+DynamicSSSP* createDynamicSSSP(Graph* graph, int source){ // 처음 한 번은 전체 계산, 시간복잡도 O((V+E)logV)
+    int num_vertices = graph->num_vertices;
+    DynamicSSSP* ds = (DynamicSSSP*) malloc(sizeof(DynamicSSSP));
+    ds->graph = graph;
+    ds->source = source;
+    ds->dist = (int*) malloc(num_vertices * sizeof(int));
+    ds->pred = (int*) malloc(num_vertices * sizeof(int));
+    ds->inList = (InEdge**) calloc(num_vertices, sizeof(InEdge*));
+    ds->mark = (unsigned int*) calloc(num_vertices, sizeof(unsigned int));
+    ds->round = 0;
+    ds->affected = (int*) malloc(num_vertices * sizeof(int));
+    ds->ws = createWorkspace(num_vertices);
+
+    int num_edges = 0;
+    for (int u = 0; u < num_vertices; ++u)
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next)
+            num_edges++;
+    ds->inPool = (InEdge*) malloc((num_edges > 0 ? num_edges : 1) * sizeof(InEdge));
+    ds->inPoolSize = num_edges;
+    for (int u = 0, k = 0; u < num_vertices; ++u)
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next)
+            addInEdge(ds, &ds->inPool[k++], u, pCrawl);
+
+    dijkstraQuery(graph, ds->ws, source, NIL);
+    for (int v = 0; v < num_vertices; ++v){
+        ds->dist[v] = wsDist(ds->ws, v);
+        ds->pred[v] = ds->dist[v] == INF ? NIL : ds->ws->pred[v];
+    }
+    return ds;
+}
+
+void freeDynamicSSSP(DynamicSSSP* ds){ // 그래프는 호출한 쪽에서 해제
+    for (int v = 0; v < ds->graph->num_vertices; ++v){
+        InEdge* in = ds->inList[v];
+        while (in){
+            InEdge* temp = in;
+            in = in->next;
+            if (temp < ds->inPool || temp >= ds->inPool + ds->inPoolSize)
+                free(temp);
+        }
+    }
+    free(ds->inPool);
+    free(ds->inList);
+    free(ds->dist);
+    free(ds->pred);
+    free(ds->mark);
+    free(ds->affected);
+    freeWorkspace(ds->ws);
+    free(ds);
+}
+
+AdjListNode* findEdge(Graph* graph, int u, int v){ // u 의 인접 리스트에서 v 로 가는 첫 간선, 시간복잡도 O(deg(u))
+    AdjListNode* edge = graph->adjList[u];
+    while (edge != NULL && edge->vertex != v)
+        edge = edge->next;
+    return edge;
+}
+
+int dsDist(DynamicSSSP* ds, int v){ // 이번 복구에서 갱신 중인 정점은 힙의 거리, 아니면 유지 중인 거리
+    return ds->ws->stamp[v] == ds->ws->version ? ds->ws->dist[v] : ds->dist[v];
+}
+
+int applyUpdates(DynamicSSSP* ds, const Edge* updates, int num_updates){ // 간선 삽입/가중치 변경 묶음을 반영하고 영향받은 부분만 복구 (Ramalingam-Reps), dist/pred 를 다시 계산한 서로 다른 정점 수 반환
+    Graph* graph = ds->graph;
+    Workspace* ws = ds->ws;
+    int num_affected = 0;
+
+    if (++ds->round == 0){
+        memset(ds->mark, 0, graph->num_vertices * sizeof(unsigned int));
+        ds->round = 1;
+    }
+    resetWorkspace(ws);
+
+    for (int i = 0; i < num_updates; ++i){ // 1) 그래프에 반영
+        int u = updates[i].src, v = updates[i].dest;
+        AdjListNode* edge = findEdge(graph, u, v);
+        if (edge == NULL){ // 새 간선 삽입
+            addEdge(graph, u, v, updates[i].weight);
+            graph->num_edges++;
+            addInEdge(ds, (InEdge*) malloc(sizeof(InEdge)), u, graph->adjList[u]);
+        } else {
+            edge->weight = updates[i].weight;
+        }
+    }
+
+    for (int i = 0; i < num_updates; ++i){ // 2) 길어진 트리 간선의 끝 정점을 영향받은 부분트리의 뿌리로 표시
+        int u = updates[i].src, v = updates[i].dest;
+        if (ds->pred[v] == u && ds->dist[u] != INF && ds->dist[u] + findEdge(graph, u, v)->weight > ds->dist[v] && ds->mark[v] != ds->round){
+            ds->mark[v] = ds->round;
+            ds->affected[num_affected++] = v;
+        }
+    }
+
+    for (int i = 0; i < num_affected; ++i){ // 3) 트리 자식을 따라가며 영향받은 부분트리 전체 수집
+        int u = ds->affected[i];
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next){
+            int v = pCrawl->vertex;
+            if (ds->pred[v] == u && ds->mark[v] != ds->round){
+                ds->mark[v] = ds->round;
+                ds->affected[num_affected++] = v;
+            }
+        }
+    }
+
+    for (int i = 0; i < num_affected; ++i){
+        ds->dist[ds->affected[i]] = INF;
+        ds->pred[ds->affected[i]] = NIL;
+    }
+
+    for (int i = 0; i < num_affected; ++i){ // 4) 영향받지 않은 정점에서 들어오는 간선으로 임시 거리 계산
+        int v = ds->affected[i];
+        int best = INF, best_pred = NIL;
+        for (InEdge* in = ds->inList[v]; in != NULL; in = in->next){
+            if (ds->mark[in->vertex] != ds->round && ds->dist[in->vertex] != INF && ds->dist[in->vertex] + in->edge->weight < best){
+                best = ds->dist[in->vertex] + in->edge->weight;
+                best_pred = in->vertex;
+            }
+        }
+        if (best != INF)
+            wsRelax(ws, v, best, best_pred);
+    }
+
+    for (int i = 0; i < num_updates; ++i){ // 5) 가중치가 줄었거나 새로 생긴 간선으로 더 짧아지는 정점
+        int u = updates[i].src, v = updates[i].dest;
+        if (ds->dist[u] == INF)
+            continue;
+        int w = findEdge(graph, u, v)->weight;
+        if (ds->dist[u] + w < dsDist(ds, v))
+            wsRelax(ws, v, ds->dist[u] + w, u);
+    }
+
+    int settled = 0; // 영향받은 부분트리 밖에서 새로 확정된 정점 수 (부분트리 안의 정점은 num_affected 에 이미 포함)
+    while (ws->size > 0){ // 6) 힙에 들어간 정점들에서만 다익스트라를 이어서 수행
+        int u = wsExtractMin(ws);
+        ds->dist[u] = ws->dist[u];
+        ds->pred[u] = ws->pred[u];
+        if (ds->mark[u] != ds->round)
+            settled++;
+
+        for (AdjListNode* pCrawl = graph->adjList[u]; pCrawl != NULL; pCrawl = pCrawl->next){
+            int v = pCrawl->vertex;
+            if (ds->dist[u] + pCrawl->weight < dsDist(ds, v))
+                wsRelax(ws, v, ds->dist[u] + pCrawl->weight, u);
+        }
+    }
+    return num_affected + settled;
+}
+
+int readUpdateBatch(FILE* ptr_updates, int num_vertices, Edge** updates, int* capacity){ // 빈 줄로 구분된 "src\tdest\tweight" 묶음 하나 읽기, 유효한 간선 수 반환 (더 읽을 묶음이 없으면 -1)
+    int count = 0, num_lines = 0;
+    char line[64];
+    while (fgets(line, sizeof(line), ptr_updates) != NULL){
+        Edge e;
+        if (sscanf(line, "%d\t%d\t%d", &e.src, &e.dest, &e.weight) != 3){
+            if (num_lines > 0)
+                break;
+            continue;
+        }
+        num_lines++;
+        if (e.src < 0 || e.src >= num_vertices || e.dest < 0 || e.dest >= num_vertices || e.weight < 0){ // 범위 밖 정점이나 음수 가중치는 다익스트라 가정을 깨므로 버림
+            printf("Invalid update: %s", line);
+            continue;
+        }
+        if (count == *capacity){
+            *capacity *= 2;
+            *updates = (Edge*) realloc(*updates, *capacity * sizeof(Edge));
+        }
+        (*updates)[count++] = e;
+    }
+    return num_lines > 0 ? count : -1;
+}
+
+typedef struct{
+    Graph* graph;
+    Workspace* ws;
+    int* path;
+} DijkstraServer;
+
+void handleRequest(void* context, char* line, Reply* reply){ // 서버 요청 처리: "DIST s t" -> 거리, "PATH s t" -> 거리와 경로, 도달 불가면 INF
+    DijkstraServer* server = (DijkstraServer*) context;
+    char command[16];
+    int s, t;
+    if (sscanf(line, "%15s %d %d", command, &s, &t) != 3 || s < 0 || s >= server->graph->num_vertices || t < 0 || t >= server->graph->num_vertices){
+        replyPrintf(reply, "ERR %s\n", line);
+        return;
+    }
+
+    int is_path = strcmp(command, "PATH") == 0;
+    if (!is_path && strcmp(command, "DIST") != 0){
+        replyPrintf(reply, "ERR %s\n", line);
+        return;
+    }
+
+    dijkstraQuery(server->graph, server->ws, s, t);
+    int dist = wsDist(server->ws, t);
+    if (dist == INF){
+        replyPrintf(reply, "INF\n");
+        return;
+    }
+    replyPrintf(reply, "%d", dist);
+    if (is_path){
+        int length = 0;
+        for (int v = t; v != NIL; v = server->ws->pred[v])
+            server->path[length++] = v;
+        while (length > 0)
+            replyPrintf(reply, " %d", server->path[--length]);
+    }
+    replyPrintf(reply, "\n");
 }
 
 int main(int argc, char *argv[]){ // main 함수, 시간복잡도 O((V+E)logV) : 다익스트라 알고리즘과 동일
-    if (argc != 3) { // 예외 처리
-        printf("Usage: %s input.txt output.txt\n", argv[0]);
+    if (argc >= 3 && strcmp(argv[1], "-serve") == 0){ // 서버 모드: 그래프를 한 번만 읽고 stdin 또는 socket 으로 질의 처리
+        Graph* graph = loadGraph(argv[2], (int) sysconf(_SC_NPROCESSORS_ONLN));
+        if (graph == NULL){
+            printf("Error opening files.\n");
+            return 1;
+        }
+        DijkstraServer server = { graph, createWorkspace(graph->num_vertices), (int*) malloc(graph->num_vertices * sizeof(int)) };
+        int status = serve(argc >= 4 ? argv[3] : NULL, handleRequest, &server);
+        freeWorkspace(server.ws);
+        free(server.path);
+        freeGraph(graph);
+        return status;
+    }
+
+    const char *queries_path = NULL, *save_path = NULL, *updates_path = NULL, *dump_path = NULL, *report_path = NULL;
+    int num_threads = (int) sysconf(_SC_NPROCESSORS_ONLN), use_scanf = 0, check = 0;
+    for (int i = 3; i < argc; ++i){ // 선택 인자 처리
+        if (strcmp(argv[i], "-q") == 0 && i + 1 < argc)
+            queries_path = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            num_threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-save") == 0 && i + 1 < argc)
+            save_path = argv[++i];
+        else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc)
+            updates_path = argv[++i];
+        else if (strcmp(argv[i], "-dump") == 0 && i + 1 < argc)
+            dump_path = argv[++i];
+        else if (strcmp(argv[i], "-report") == 0 && i + 1 < argc)
+            report_path = argv[++i];
+        else if (strcmp(argv[i], "-scanf") == 0)
+            use_scanf = 1;
+        else if (strcmp(argv[i], "-check") == 0)
+            check = 1;
+        else
+            argc = 0;
+    }
+    if ((queries_path != NULL && (updates_path != NULL || dump_path != NULL || report_path != NULL))
+        || (updates_path != NULL && report_path != NULL) || (check && updates_path == NULL))
+        argc = 0; // 해당 모드에서 쓰이지 않는 선택 인자는 조용히 무시하지 않고 사용법 출력
+    if (argc < 3) { // 예외 처리
+        printf("Usage: %s input.txt output.txt [-t threads] [-save graph.bin] [-scanf] [-dump result.bin] [-report report.json]\n", argv[0]);
+        printf("       %s input.txt output.txt -q queries.txt [-t threads] [-save graph.bin] [-scanf]\n", argv[0]);
+        printf("       %s input.txt output.txt -u updates.txt [-check] [-t threads] [-save graph.bin] [-scanf] [-dump result.bin]\n", argv[0]);
+        printf("       %s -serve input.txt [socket]\n", argv[0]);
         return 1;
     }
+    if (num_threads < 1)
+        num_threads = 1;
 
-    FILE *ptr_input = fopen(argv[1], "r");
     FILE *ptr_output = fopen(argv[2], "w");
-    if (ptr_input == NULL || ptr_output == NULL){
+    if (ptr_output == NULL){
         printf("Error opening files.\n");
         return 1;
     }
 
-    int num_vertices, num_edges, source;
-    fscanf(ptr_input, "%d\t%d\t%d", &num_vertices, &num_edges, &source);
+    DijkstraStats stats;
+    memset(&stats, 0, sizeof(stats));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
 
-    Graph* graph = createGraph(num_vertices, num_edges, source);
+    Graph* graph = NULL;
+    if (use_scanf){
+        FILE *ptr_input = fopen(argv[1], "r");
+        if (ptr_input != NULL){
+            graph = loadGraphScanf(ptr_input);
+            fclose(ptr_input);
+        }
+    } else {
+        graph = loadGraph(argv[1], num_threads); // 텍스트 또는 -save 로 만든 바이너리 파일
+    }
+    if (graph == NULL){
+        printf("Error opening files.\n");
+        return 1;
+    }
+    stats.load_seconds = elapsedSince(&start);
 
-    for (int i = 0; i < num_edges; ++i){
-        int src, dest, weight;
-        fscanf(ptr_input, "%d\t%d\t%d", &src, &dest, &weight);
-        addEdge(graph, src, dest, weight);
+    if (save_path != NULL && saveGraphBinary(graph, save_path) != 0){
+        printf("Error opening files.\n");
+        return 1;
     }
 
-    fclose(ptr_input);
+    if (queries_path != NULL){ // 질의 파일이 주어지면 배치 모드: 질의마다 "source\ttarget\tdist\treached" 출력
+        FILE *ptr_queries = fopen(queries_path, "r");
+        if (ptr_queries == NULL){
+            printf("Error opening files.\n");
+            return 1;
+        }
+        int num_queries;
+        Query* queries = readQueries(ptr_queries, graph->num_vertices, &num_queries);
+        fclose(ptr_queries);
 
-    dijkstra(graph);
+        double elapsed = dijkstraBatch(graph, queries, num_queries, num_threads);
+        printf("%d queries, %d threads: %.3f s, %.0f queries/s\n", num_queries, num_threads, elapsed, num_queries / elapsed);
 
-    for (int i = 0; i < num_vertices; ++i){
-        AdjListNode* pCrawl = graph->adjList[i];
-        while (pCrawl){
-            AdjListNode* temp = pCrawl;
-            pCrawl = pCrawl->next;
-            free(temp);
+        OutputBuffer* out = createOutputBuffer(ptr_output);
+        for (int i = 0; i < num_queries; ++i){
+            reserveOutput(out, 64);
+            putInt(out, queries[i].source);
+            putText(out, "\t");
+            if (queries[i].target == NIL)
+                putText(out, "NIL");
+            else
+                putInt(out, queries[i].target);
+            putText(out, "\t");
+            putInt(out, queries[i].dist);
+            putText(out, "\t");
+            putInt(out, queries[i].reached);
+            putText(out, "\n");
+        }
+        freeOutputBuffer(out);
+        free(queries);
+    } else if (updates_path != NULL){ // 간선 변경 모드: 묶음마다 영향받은 부분만 복구하고 마지막 결과를 출력 (-dump 도 마지막 결과)
+        FILE *ptr_updates = fopen(updates_path, "r");
+        if (ptr_updates == NULL){
+            printf("Error opening files.\n");
+            return 1;
+        }
+        DynamicSSSP* ds = createDynamicSSSP(graph, graph->source);
+        Workspace* check_ws = check ? createWorkspace(graph->num_vertices) : NULL;
+        int capacity = 1024, num_updates, mismatches = 0;
+        Edge* updates = (Edge*) malloc(capacity * sizeof(Edge));
+
+        for (int batch = 0; (num_updates = readUpdateBatch(ptr_updates, graph->num_vertices, &updates, &capacity)) >= 0; ++batch){
+            struct timespec start;
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            int repaired = applyUpdates(ds, updates, num_updates);
+            printf("batch %d: %d updates, %d vertices repaired, %.3f ms", batch, num_updates, repaired, elapsedSince(&start) * 1e3);
+
+            if (check){ // 전체 재계산과 비교: dist 가 같고 pred 가 실제 최단경로 간선인지 확인
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                dijkstraQuery(graph, check_ws, graph->source, NIL);
+                double full = elapsedSince(&start);
+                int bad = 0;
+                for (int v = 0; v < graph->num_vertices; ++v){
+                    if (wsDist(check_ws, v) != ds->dist[v]){
+                        bad++;
+                    } else if (ds->dist[v] != INF && v != graph->source){
+                        AdjListNode* pCrawl = graph->adjList[ds->pred[v]];
+                        while (pCrawl != NULL && !(pCrawl->vertex == v && ds->dist[ds->pred[v]] + pCrawl->weight == ds->dist[v]))
+                            pCrawl = pCrawl->next;
+                        bad += pCrawl == NULL;
+                    }
+                }
+                printf(", full recompute %.3f ms, %d mismatches", full * 1e3, bad);
+                mismatches += bad;
+            }
+            printf("\n");
+        }
+        fclose(ptr_updates);
+
+        writeResult(ptr_output, ds->dist, ds->pred, graph->num_vertices, graph->source);
+        int status = dump_path != NULL ? writeResultBinary(dump_path, ds->dist, ds->pred, graph->num_vertices, graph->source) : 0;
+        free(updates);
+        if (check_ws != NULL)
+            freeWorkspace(check_ws);
+        freeDynamicSSSP(ds);
+        if (status != 0)
+            printf("Error opening files.\n");
+        if (status != 0 || mismatches > 0){
+            freeGraph(graph);
+            fclose(ptr_output);
+            return 1;
+        }
+    } else { // 기본 모드: 한 source 에 대한 결과를 output 경로에 쓰고, 요청하면 바이너리 dist/pred 와 계측 결과도 저장
+        int* dist = (int*) malloc(graph->num_vertices * sizeof(int));
+        int* pred = (int*) malloc(graph->num_vertices * sizeof(int));
+        dijkstra(graph, dist, pred, &stats);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        writeResult(ptr_output, dist, pred, graph->num_vertices, graph->source);
+        fflush(ptr_output);
+        int status = dump_path != NULL ? writeResultBinary(dump_path, dist, pred, graph->num_vertices, graph->source) : 0;
+        stats.output_seconds = elapsedSince(&start);
+
+        if (status == 0 && report_path != NULL)
+            status = writeReport(report_path, graph, &stats);
+        free(dist);
+        free(pred);
+        if (status != 0){
+            printf("Error opening files.\n");
+            freeGraph(graph);
+            fclose(ptr_output);
+            return 1;
         }
     }
-    free(graph->adjList);
-    free(graph);
 
-    fclose(ptr_input); // 입출력파일 닫기
-    fclose(ptr_output);
+    freeGraph(graph);
+
+    fclose(ptr_output); // 출력파일 닫기
 
     return 0;
-}
\ No newline at end of file
+}
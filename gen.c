@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> // 필요한 헤더파일 불러오기
+
+// 벤치마크용 입력 생성기, 결과는 stdout 으로 출력 (같은 seed 면 같은 입력)
+
+unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+unsigned long long nextRandom(){ // xorshift64*, 시간복잡도 = O(1)
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+int randomRange(int n){ // [0, n) 범위의 난수
+    return (int) (nextRandom() % (unsigned long long) n);
+}
+
+int* permutation(int n){ // 0..n-1 의 무작위 순열 (Fisher-Yates), 시간복잡도 = O(n)
+    int* keys = (int*) malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int i = 0; i < n; ++i)
+        keys[i] = i;
+    for (int i = n - 1; i > 0; --i){
+        int j = randomRange(i + 1);
+        int t = keys[i];
+        keys[i] = keys[j];
+        keys[j] = t;
+    }
+    return keys;
+}
+
+void genStack(int n, int max_depth){ // stack.c 명령열: H(push) / O(pop) / T(top), 스택 깊이는 max_depth 이하로 유지
+    int depth = 0;
+    for (int i = 0; i < n; ++i){
+        int r = randomRange(10);
+        if (depth == 0 || (r < 5 && depth < max_depth)){
+            printf("H\t%d\n", randomRange(1000000));
+            depth++;
+        } else if (r < 8){
+            printf("O\n");
+            depth--;
+        } else{
+            printf("T\n");
+        }
+    }
+}
+
+void genPalindrome(int n){ // "P\t단어" 줄, 절반은 회문, 단어 길이는 stack.c 의 버퍼(100) 미만
+    char word[100];
+    for (int i = 0; i < n; ++i){
+        int length = 1 + randomRange(98);
+        for (int j = 0; j < length; ++j)
+            word[j] = 'a' + randomRange(i % 2 ? 26 : 3);
+        if (i % 2 == 0){
+            for (int j = 0; j < length / 2; ++j)
+                word[length - 1 - j] = word[j];
+        }
+        word[length] = '\0';
+        printf("P\t%s\n", word);
+    }
+}
+
+void genBracket(int n, int max_length){ // "B" 다음 줄부터 괄호식, 절반은 균형 잡힌 식이고 나머지는 한 글자를 바꿈
+    const char* open = "([{";
+    const char* close = ")]}";
+    char* line = (char*) malloc(max_length + 1);
+    char* stack = (char*) malloc(max_length + 1);
+    printf("B\n");
+    for (int i = 0; i < n; ++i){
+        int length = 2 * (1 + randomRange(max_length / 2));
+        int top = 0, k = 0;
+        while (k < length){
+            if (top > 0 && (top == length - k || randomRange(2))){
+                line[k++] = close[(int) stack[--top]];
+            } else{
+                int type = randomRange(3);
+                stack[top++] = type;
+                line[k++] = open[type];
+            }
+        }
+        if (i % 2)
+            line[randomRange(length)] = "()[]{}"[randomRange(6)];
+        line[length] = '\0';
+        printf("%s\n", line);
+    }
+    free(line);
+    free(stack);
+}
+
+void genRB(int n, const char* order){ // rb.c 입력: 첫 줄 삽입 키 n개, 둘째 줄 삭제 키 n/2개
+    int* keys;
+    if (strcmp(order, "sorted") == 0){
+        keys = (int*) malloc((n > 0 ? n : 1) * sizeof(int));
+        for (int i = 0; i < n; ++i)
+            keys[i] = i;
+    } else if (strcmp(order, "adversarial") == 0){ // 양 끝에서 번갈아 삽입 (0, n-1, 1, n-2, ...) 해서 회전이 계속 일어나게 함
+        keys = (int*) malloc((n > 0 ? n : 1) * sizeof(int));
+        for (int i = 0, lo = 0, hi = n - 1; i < n; ++i)
+            keys[i] = i % 2 ? hi-- : lo++;
+    } else{
+        keys = permutation(n);
+    }
+    for (int i = 0; i < n; ++i)
+        printf("%d ", keys[i]);
+    printf("\n");
+    free(keys);
+
+    keys = permutation(n);
+    for (int i = 0; i < n / 2; ++i)
+        printf("%d ", keys[i]);
+    printf("\n");
+    free(keys);
+}
+
+void genGrid(int n){ // n x n 격자, 상하좌우 양방향 간선
+    int num_vertices = n * n;
+    int num_edges = 4 * n * (n - 1);
+    printf("%d\t%d\t0\n", num_vertices, num_edges);
+    for (int r = 0; r < n; ++r){
+        for (int c = 0; c < n; ++c){
+            int u = r * n + c;
+            if (c + 1 < n){
+                printf("%d\t%d\t%d\n", u, u + 1, 1 + randomRange(100));
+                printf("%d\t%d\t%d\n", u + 1, u, 1 + randomRange(100));
+            }
+            if (r + 1 < n){
+                printf("%d\t%d\t%d\n", u, u + n, 1 + randomRange(100));
+                printf("%d\t%d\t%d\n", u + n, u, 1 + randomRange(100));
+            }
+        }
+    }
+}
+
+void genRandomGraph(int num_vertices, int num_edges){ // 균일한 무작위 방향 그래프
+    printf("%d\t%d\t0\n", num_vertices, num_edges);
+    for (int i = 0; i < num_edges; ++i)
+        printf("%d\t%d\t%d\n", randomRange(num_vertices), randomRange(num_vertices), 1 + randomRange(1000));
+}
+
+void genPowerLaw(int num_vertices, int num_edges){ // 간선 복사 모델: 절반 확률로 이전 간선의 끝점을 재사용해서 차수가 멱법칙을 따름
+    int* src = (int*) malloc((num_edges > 0 ? num_edges : 1) * sizeof(int));
+    int* dest = (int*) malloc((num_edges > 0 ? num_edges : 1) * sizeof(int));
+    printf("%d\t%d\t0\n", num_vertices, num_edges);
+    for (int i = 0; i < num_edges; ++i){
+        src[i] = i > 0 && randomRange(2) ? src[randomRange(i)] : randomRange(num_vertices);
+        dest[i] = i > 0 && randomRange(2) ? dest[randomRange(i)] : randomRange(num_vertices);
+        printf("%d\t%d\t%d\n", src[i], dest[i], 1 + randomRange(1000));
+    }
+    free(src);
+    free(dest);
+}
+
+void genQueries(int num_vertices, int n, int span){ // dijkstra 배치 질의 "source\ttarget", span > 0 이면 target 은 source 에서 번호 차이 span 미만 (격자에서는 같은 행의 가까운 정점)
+    for (int i = 0; i < n; ++i){
+        int source = randomRange(num_vertices);
+        int target = span > 0 ? (source + randomRange(span)) % num_vertices : randomRange(num_vertices);
+        printf("%d\t%d\n", source, target);
+    }
+}
+
+int genUpdates(const char* graph_path, int batches, int batch_size, int max_weight){ // dijkstra -u 입력: 빈 줄로 구분된 묶음, 대부분은 기존 간선의 가중치를 0..max_weight 로 바꾸고 약 10% 는 새 간선 삽입 (중복 간선 포함)
+    if (max_weight < 0)
+        max_weight = 0;
+    FILE* ptr_input = fopen(graph_path, "r");
+    int num_vertices, num_edges, source;
+    if (ptr_input == NULL || fscanf(ptr_input, "%d %d %d", &num_vertices, &num_edges, &source) != 3 || num_vertices <= 0){
+        printf("Error opening files.\n");
+        if (ptr_input != NULL)
+            fclose(ptr_input);
+        return 1;
+    }
+    int capacity = (num_edges > 0 ? num_edges : 0) + (batches > 0 && batch_size > 0 ? batches * batch_size : 0) + 1;
+    int* src = (int*) malloc(capacity * sizeof(int));
+    int* dest = (int*) malloc(capacity * sizeof(int));
+    int count = 0, weight;
+    while (count < num_edges && fscanf(ptr_input, "%d %d %d", &src[count], &dest[count], &weight) == 3)
+        count++;
+    fclose(ptr_input);
+
+    for (int b = 0; b < batches; ++b){
+        if (b > 0)
+            printf("\n");
+        for (int i = 0; i < batch_size; ++i){
+            int k;
+            if (count == 0 || randomRange(10) == 0){ // 삽입한 간선도 이후 묶음에서 다시 바뀔 수 있게 목록에 추가
+                k = count++;
+                src[k] = randomRange(num_vertices);
+                dest[k] = randomRange(num_vertices);
+            } else{
+                k = randomRange(count);
+            }
+            printf("%d\t%d\t%d\n", src[k], dest[k], randomRange(max_weight + 1));
+        }
+    }
+    free(src);
+    free(dest);
+    return 0;
+}
+
+int main(int argc, char *argv[]){
+    if (argc < 3){
+        printf("Usage: %s stack N [max_depth] | palindrome N | bracket N [max_length]\n", argv[0]);
+        printf("       %s rb N sorted|random|adversarial\n", argv[0]);
+        printf("       %s grid N | random V E | powerlaw V E | queries V N [span]\n", argv[0]);
+        printf("       %s updates graph.txt batches batch_size [max_weight]\n", argv[0]);
+        printf("       (SEED 환경변수로 seed 지정)\n");
+        return 1;
+    }
+    if (getenv("SEED") != NULL)
+        state ^= strtoull(getenv("SEED"), NULL, 10) * 0x9E3779B97F4A7C15ULL;
+
+    static char buffer[1 << 20]; // 큰 출력 버퍼
+    setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+
+    const char* kind = argv[1];
+    int n = atoi(argv[2]);
+    int m = argc > 3 ? atoi(argv[3]) : 0;
+
+    if (strcmp(kind, "stack") == 0)
+        genStack(n, m > 0 ? m : 64);
+    else if (strcmp(kind, "palindrome") == 0)
+        genPalindrome(n);
+    else if (strcmp(kind, "bracket") == 0)
+        genBracket(n, m > 1 ? m : 200);
+    else if (strcmp(kind, "rb") == 0)
+        genRB(n, argc > 3 ? argv[3] : "random");
+    else if (strcmp(kind, "grid") == 0)
+        genGrid(n);
+    else if (strcmp(kind, "random") == 0 && argc > 3)
+        genRandomGraph(n, m);
+    else if (strcmp(kind, "powerlaw") == 0 && argc > 3)
+        genPowerLaw(n, m);
+    else if (strcmp(kind, "queries") == 0 && argc > 3)
+        genQueries(n, m, argc > 4 ? atoi(argv[4]) : 0);
+    else if (strcmp(kind, "updates") == 0 && argc > 4)
+        return genUpdates(argv[2], m, atoi(argv[4]), argc > 5 ? atoi(argv[5]) : 40);
+    else{
+        printf("Unknown generator: %s\n", kind);
+        return 1;
+    }
+    return 0;
+}
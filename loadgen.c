@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h> // 필요한 헤더파일 불러오기
+
+// -serve 모드로 띄운 stack, rb, dijkstra 서버에 요청을 pipelining 으로 보내고 지연시간 분포와 처리량 측정
+
+#define MAX_REQUEST 4096 // 요청 한 줄의 최대 길이 (개행 포함)
+
+long long nowNanos(){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+int compareLong(const void *a, const void *b){
+    long long x = *(const long long *) a, y = *(const long long *) b;
+    return (x > y) - (x < y);
+}
+
+char **readRequests(const char *path, int *count){ // 요청 파일을 줄 단위로 읽음, 요청은 순서대로 반복 사용
+    FILE *ptr_input = fopen(path, "r");
+    if (ptr_input == NULL)
+        return NULL;
+
+    int capacity = 1024;
+    char **lines = (char **) malloc(capacity * sizeof(char *));
+    char line[MAX_REQUEST + 1];
+    int line_number = 0;
+    *count = 0;
+    while (fgets(line, sizeof(line), ptr_input) != NULL){
+        size_t length = strlen(line);
+        line_number++;
+        if (line[length-1] != '\n' && length == MAX_REQUEST){ // 개행을 붙일 자리가 없으면 줄의 나머지를 버리고 건너뜀
+            int ch;
+            while ((ch = fgetc(ptr_input)) != EOF && ch != '\n') {}
+            printf("Request too long: line %d (max %d bytes)\n", line_number, MAX_REQUEST - 1);
+            continue;
+        }
+        if (length <= 1)
+            continue;
+        if (line[length-1] != '\n'){
+            line[length++] = '\n';
+            line[length] = '\0';
+        }
+        if (*count == capacity){
+            capacity *= 2;
+            lines = (char **) realloc(lines, capacity * sizeof(char *));
+        }
+        lines[(*count)++] = strdup(line);
+    }
+    fclose(ptr_input);
+    return lines;
+}
+
+int main(int argc, char *argv[]){ // 시간복잡도 O(N log N) : 지연시간 정렬
+    if (argc < 3){
+        printf("Usage: %s socket requests.txt [-n total] [-d depth]\n", argv[0]);
+        return 1;
+    }
+    int total = 100000, depth = 64;
+    for (int i = 3; i + 1 < argc; i += 2){
+        if (strcmp(argv[i], "-n") == 0)
+            total = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "-d") == 0)
+            depth = atoi(argv[i+1]);
+    }
+    if (depth < 1)
+        depth = 1;
+    if (total < 1)
+        total = 1;
+
+    int num_requests;
+    char **requests = readRequests(argv[2], &num_requests);
+    if (requests == NULL){
+        printf("Error opening files.\n");
+        return 1;
+    }
+    if (num_requests == 0){
+        printf("No requests in %s.\n", argv[2]);
+        return 1;
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, argv[1], sizeof(addr.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0){
+        printf("Error opening socket.\n");
+        return 1;
+    }
+
+    long long *sent_at = (long long *) malloc(total * sizeof(long long));
+    long long *latency = (long long *) malloc(total * sizeof(long long));
+    char *out = (char *) malloc((size_t) depth * MAX_REQUEST);
+    char in[65536];
+    int sent = 0, received = 0;
+
+    long long start = nowNanos();
+    while (received < total){
+        size_t length = 0;
+        while (sent < total && sent - received < depth){ // 창(depth)이 허용하는 만큼 모아서 write 한 번
+            const char *request = requests[sent % num_requests];
+            size_t n = strlen(request);
+            memcpy(out + length, request, n);
+            length += n;
+            sent_at[sent++] = nowNanos();
+        }
+        for (size_t offset = 0; offset < length; ){
+            ssize_t n = write(fd, out + offset, length - offset);
+            if (n <= 0){
+                printf("Connection closed.\n");
+                return 1;
+            }
+            offset += n;
+        }
+
+        ssize_t n = read(fd, in, sizeof(in));
+        if (n <= 0){
+            printf("Connection closed.\n");
+            return 1;
+        }
+        long long now = nowNanos();
+        for (ssize_t i = 0; i < n; ++i){ // 응답은 요청마다 한 줄
+            if (in[i] == '\n'){
+                latency[received] = now - sent_at[received];
+                received++;
+            }
+        }
+    }
+    double elapsed = (nowNanos() - start) / 1e9;
+    if (write(fd, "QUIT\n", 5) != 5) // 측정은 끝났으므로 알리기만 함
+        printf("Connection closed.\n");
+    close(fd);
+
+    qsort(latency, total, sizeof(long long), compareLong);
+    printf("requests %d, depth %d, %.3f s, %.0f req/s\n", total, depth, elapsed, total / elapsed);
+    printf("latency us: p50 %.1f p90 %.1f p99 %.1f p99.9 %.1f max %.1f\n",
+        latency[(int) (total * 0.50)] / 1e3, latency[(int) (total * 0.90)] / 1e3,
+        latency[(int) (total * 0.99)] / 1e3, latency[(int) (total * 0.999)] / 1e3, latency[total-1] / 1e3);
+
+    for (int i = 0; i < num_requests; ++i)
+        free(requests[i]);
+    free(requests);
+    free(sent_at);
+    free(latency);
+    free(out);
+    return 0;
+}
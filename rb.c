@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdbool.h> // 필요한 헤더파일 불러오기
+#include <stdbool.h>
+#include "server.h" // 필요한 헤더파일 불러오기
 
 typedef enum { RED, BLACK } Color;
 
@@ -20,9 +21,12 @@ void delete(rbnode **root, rbnode *z);
 void deleteFixup(rbnode **root, rbnode *x);
 void transplant(rbnode **root, rbnode *u, rbnode *v);
 rbnode* minimum(rbnode *node);
+rbnode* search(rbnode *root, int key);
 void printInorder(rbnode *root, FILE *file);
 void printLevelorder(rbnode *root, FILE *file); // 해당되는 함수들
 
+int verbose = 1; // delete 과정의 터미널 출력 여부 (서버 모드에서는 응답과 섞이지 않도록 끔)
+
 rbnode* createNode(int key) { // node 생성, O(1)
     rbnode *new_node = (rbnode *)malloc(sizeof(rbnode));
     if (new_node == NULL) {
@@ -227,7 +231,8 @@ rbnode* minimum(rbnode *node) { // 최솟값 찾기
 }
 
 void delete(rbnode **root, rbnode *z) { // delete 수행, O(log N)
-    printf("Deleting node with key: %d\n", z->key); // 삭제 직전의 키 출력 (터미널에서 검토용)
+    if (verbose)
+        printf("Deleting node with key: %d\n", z->key); // 삭제 직전의 키 출력 (터미널에서 검토용)
     rbnode *y = z;
     rbnode *x;
     int original_color = y->color;
@@ -259,6 +264,7 @@ void delete(rbnode **root, rbnode *z) { // delete 수행, O(log N)
         deleteFixup(root, x);
     }
     free(z);
+    if (!verbose) return;
     printf("After deletion:\n"); // 추가: 삭제 후의 트리 상태 출력 (터미널에서 검토용)
     printInorder(*root, stdout);
     printf("\n");
@@ -266,6 +272,17 @@ void delete(rbnode **root, rbnode *z) { // delete 수행, O(log N)
     printf("\n");
 }
 
+rbnode* search(rbnode *root, int key) { // key 를 가진 노드 찾기, 없으면 NULL, O(log N)
+    while (root != NULL && key != root->key) {
+        if (key < root->key) {
+            root = root->left;
+        } else {
+            root = root->right;
+        }
+    }
+    return root;
+}
+
 void printInorder(rbnode *root, FILE *file) { // In-Order 순회결과 출력, O(N)
     if (root != NULL) {
         printInorder(root->left, file);
@@ -277,7 +294,8 @@ void printInorder(rbnode *root, FILE *file) { // In-Order 순회결과 출력, O
 void printLevelorder(rbnode *root, FILE *file) { // Level-Order 순회결과 출력, O(N)
     if (root == NULL) return;
 
-    rbnode *queue[1000];
+    int capacity = 1024; // 노드 수에 맞춰 늘어나는 큐
+    rbnode **queue = (rbnode **)malloc(capacity * sizeof(rbnode *));
     int front = 0, rear = 0;
     queue[rear++] = root;
 
@@ -285,6 +303,10 @@ void printLevelorder(rbnode *root, FILE *file) { // Level-Order 순회결과 출
         rbnode *current = queue[front++];
         fprintf(file, "%d ", current->key);
 
+        if (rear + 2 > capacity) {
+            capacity *= 2;
+            queue = (rbnode **)realloc(queue, capacity * sizeof(rbnode *));
+        }
         if (current->left != NULL) {
             queue[rear++] = current->left;
         }
@@ -292,11 +314,84 @@ void printLevelorder(rbnode *root, FILE *file) { // Level-Order 순회결과 출
             queue[rear++] = current->right;
         }
     }
+    free(queue);
+}
+
+void rangeQuery(rbnode *root, int lo, int hi, Reply *reply) { // lo <= key <= hi 인 키를 오름차순으로 응답에 추가, O(log N + K)
+    if (root == NULL) return;
+    if (lo < root->key) rangeQuery(root->left, lo, hi, reply);
+    if (lo <= root->key && root->key <= hi) replyPrintf(reply, " %d", root->key);
+    if (root->key < hi) rangeQuery(root->right, lo, hi, reply);
+}
+
+typedef struct {
+    rbnode *root;
+    int size;
+} RBServer;
+
+void handleRequest(void *context, char *line, Reply *reply) { // 서버 요청 처리: INSERT k, DELETE k, FIND k, RANGE lo hi, SIZE
+    RBServer *server = (RBServer *)context;
+    char command[16];
+    int a, b;
+    int n = sscanf(line, "%15s %d %d", command, &a, &b);
+
+    if (n == 2 && strcmp(command, "INSERT") == 0) {
+        if (search(server->root, a) != NULL) {
+            replyPrintf(reply, "EXISTS\n");
+        } else {
+            insert(&server->root, createNode(a));
+            server->size++;
+            replyPrintf(reply, "OK\n");
+        }
+    } else if (n == 2 && strcmp(command, "DELETE") == 0) {
+        rbnode *z = search(server->root, a);
+        if (z == NULL) {
+            replyPrintf(reply, "NOTFOUND\n");
+        } else {
+            delete(&server->root, z);
+            server->size--;
+            replyPrintf(reply, "OK\n");
+        }
+    } else if (n == 2 && strcmp(command, "FIND") == 0) {
+        replyPrintf(reply, search(server->root, a) != NULL ? "1\n" : "0\n");
+    } else if (n == 3 && strcmp(command, "RANGE") == 0) {
+        replyPrintf(reply, "RANGE");
+        rangeQuery(server->root, a, b, reply);
+        replyPrintf(reply, "\n");
+    } else if (n >= 1 && strcmp(command, "SIZE") == 0) {
+        replyPrintf(reply, "%d\n", server->size);
+    } else {
+        replyPrintf(reply, "ERR %s\n", line);
+    }
 }
 
 int main(int argc, char *argv[]) { // main 함수, 시간복잡도 O(NlogN)
+    if (argc >= 3 && strcmp(argv[1], "-serve") == 0) { // 서버 모드: 입력 파일의 키를 한 번만 삽입하고 stdin 또는 socket 으로 요청 처리
+        FILE *ptr_keys = fopen(argv[2], "r");
+        if (ptr_keys == NULL) {
+            printf("Error opening files.\n");
+            return 1;
+        }
+        RBServer server = { NULL, 0 };
+        int key;
+        while (fscanf(ptr_keys, "%d", &key) == 1) {
+            if (search(server.root, key) == NULL) {
+                insert(&server.root, createNode(key));
+                server.size++;
+            }
+        }
+        fclose(ptr_keys);
+        verbose = 0;
+        return serve(argc >= 4 ? argv[3] : NULL, handleRequest, &server);
+    }
+
+    if (argc == 4 && strcmp(argv[3], "-quiet") == 0) { // 대량 입력에서 delete 마다 트리 전체를 출력하지 않도록
+        verbose = 0;
+        argc = 3;
+    }
     if (argc != 3) { // 예외 처리
-        printf("Usage: %s input.txt output.txt\n", argv[0]);
+        printf("Usage: %s input.txt output.txt [-quiet]\n", argv[0]);
+        printf("       %s -serve keys.txt [socket]\n", argv[0]);
         return 1;
     }
 
@@ -326,17 +421,7 @@ int main(int argc, char *argv[]) { // main 함수, 시간복잡도 O(NlogN)
     rewind(ptr_input); // 이하는 3, 4번째 줄 출력을 위한 과정
     while (fgetc(ptr_input) != '\n') {}
     while (fscanf(ptr_input, "%d", &num) == 1) {
-        rbnode *to_delete = NULL;
-        to_delete = original_root;
-        while (to_delete != NULL) {
-            if (num == to_delete->key) {
-                break;
-            } else if (num < to_delete->key) {
-                to_delete = to_delete->left;
-            } else {
-                to_delete = to_delete->right;
-            }
-        }
+        rbnode *to_delete = search(original_root, num);
         if (to_delete != NULL) {
             delete(&root, to_delete);
         }
@@ -0,0 +1,233 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h> // stack.c, rb.c, dijkstra.c 가 함께 쓰는 줄 단위 요청 서버
+
+#define SERVER_BUFFER 65536   // 한 번에 읽는 크기
+#define SERVER_MAX_CLIENTS 64
+#define SERVER_MAX_LINE 4096  // 요청 한 줄의 최대 길이, 넘으면 ERR 로 응답하고 그 줄은 버림
+
+#define SERVE_CONTINUE 0
+#define SERVE_CLOSE 1         // 이 연결만 닫기 (QUIT)
+#define SERVE_SHUTDOWN 2      // 서버 종료 (SHUTDOWN)
+
+typedef struct{
+    char *data;
+    size_t length;
+    size_t capacity;
+} Reply; // 한 번의 read 로 들어온 요청들의 응답을 모아서 write 한 번으로 보냄
+
+typedef void (*RequestHandler)(void *context, char *line, Reply *reply); // 요청 한 줄을 처리하고 응답 한 줄을 덧붙임
+
+typedef struct{
+    int in_fd;
+    int out_fd;
+    char *buffer;   // 아직 처리하지 않은 입력 (줄 중간에서 끊긴 부분)
+    size_t length;
+    size_t capacity;
+    Reply pending;  // 아직 보내지 못한 응답, 남아 있는 동안은 이 연결의 요청을 더 읽지 않음
+    size_t sent;    // pending 중 이미 보낸 길이
+    int closing;    // QUIT 또는 EOF 이후 남은 응답만 보내고 닫음
+    int discarding; // 너무 긴 줄의 나머지를 개행이 나올 때까지 버리는 중
+} Connection;
+
+static void replyReserve(Reply *reply, size_t extra){
+    if (reply->length + extra <= reply->capacity)
+        return;
+    while (reply->length + extra > reply->capacity)
+        reply->capacity = reply->capacity ? reply->capacity * 2 : SERVER_BUFFER;
+    reply->data = (char *) realloc(reply->data, reply->capacity);
+}
+
+static void replyPrintf(Reply *reply, const char *format, ...){ // 응답 버퍼에 printf, 모자라면 늘려서 다시 씀
+    va_list args;
+    va_start(args, format);
+    replyReserve(reply, 64);
+    int n = vsnprintf(reply->data + reply->length, reply->capacity - reply->length, format, args);
+    va_end(args);
+    if ((size_t) n >= reply->capacity - reply->length){
+        replyReserve(reply, n + 1);
+        va_start(args, format);
+        vsnprintf(reply->data + reply->length, reply->capacity - reply->length, format, args);
+        va_end(args);
+    }
+    reply->length += n;
+}
+
+static int connectionFlush(Connection *c){ // 남은 응답을 쓸 수 있는 만큼 write (non-blocking socket 이면 EAGAIN 에서 멈춤), 쓰기 실패면 응답을 버리고 -1
+    while (c->sent < c->pending.length){
+        ssize_t n = write(c->out_fd, c->pending.data + c->sent, c->pending.length - c->sent);
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return 0;
+        if (n <= 0){
+            c->pending.length = c->sent = 0;
+            return -1;
+        }
+        c->sent += n;
+    }
+    c->pending.length = c->sent = 0;
+    return 0;
+}
+
+static void connectionFree(Connection *c){
+    close(c->in_fd);
+    free(c->buffer);
+    free(c->pending.data);
+}
+
+static int connectionRead(Connection *c, RequestHandler handler, void *context){ // read 한 번, 완성된 줄을 모두 처리하고 응답을 한 번에 write
+    if (c->capacity - c->length < SERVER_BUFFER){
+        c->capacity = c->length + SERVER_BUFFER;
+        c->buffer = (char *) realloc(c->buffer, c->capacity);
+    }
+    ssize_t n = read(c->in_fd, c->buffer + c->length, c->capacity - c->length);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        return SERVE_CONTINUE;
+    if (n <= 0){
+        if (c->length == 0)
+            return SERVE_CLOSE;
+        c->buffer[c->length++] = '\n'; // 개행 없이 끝난 마지막 줄도 처리하고 닫음
+    } else{
+        c->length += n;
+    }
+
+    int status = SERVE_CONTINUE;
+    size_t start = 0;
+    if (c->discarding){
+        char *newline = (char *) memchr(c->buffer, '\n', c->length);
+        start = newline != NULL ? (size_t) (newline - c->buffer) + 1 : c->length;
+        c->discarding = newline == NULL;
+    }
+    for (size_t i = start; i < c->length && status == SERVE_CONTINUE; ++i){
+        if (c->buffer[i] != '\n')
+            continue;
+        c->buffer[i] = '\0';
+        if (i > start && c->buffer[i-1] == '\r')
+            c->buffer[i-1] = '\0';
+
+        char *line = c->buffer + start;
+        size_t line_length = i - start;
+        start = i + 1;
+        if (line_length > SERVER_MAX_LINE)
+            replyPrintf(&c->pending, "ERR line too long\n");
+        else if (strcmp(line, "QUIT") == 0)
+            status = SERVE_CLOSE;
+        else if (strcmp(line, "SHUTDOWN") == 0)
+            status = SERVE_SHUTDOWN;
+        else if (line[0] != '\0')
+            handler(context, line, &c->pending);
+    }
+    memmove(c->buffer, c->buffer + start, c->length - start);
+    c->length -= start;
+    if (c->length > SERVER_MAX_LINE && status == SERVE_CONTINUE){ // 개행 없이 계속 들어오는 줄 때문에 버퍼가 끝없이 커지지 않게 함
+        replyPrintf(&c->pending, "ERR line too long\n");
+        c->length = 0;
+        c->discarding = 1;
+    }
+
+    if (connectionFlush(c) != 0)
+        return SERVE_CLOSE;
+    return n <= 0 && status == SERVE_CONTINUE ? SERVE_CLOSE : status;
+}
+
+static int serve(const char *socket_path, RequestHandler handler, void *context){ // socket_path 가 NULL 이면 stdin/stdout, 아니면 Unix domain socket 에서 poll 로 여러 연결 처리
+    signal(SIGPIPE, SIG_IGN);
+
+    if (socket_path == NULL){ // stdout 은 blocking 이라 connectionFlush 가 응답을 다 씀
+        Connection c = { STDIN_FILENO, STDOUT_FILENO, NULL, 0, 0, { NULL, 0, 0 }, 0, 0, 0 };
+        while (connectionRead(&c, handler, context) == SERVE_CONTINUE) {}
+        free(c.buffer);
+        free(c.pending.data);
+        return 0;
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path, sizeof(addr.sun_path) - 1);
+
+    struct stat st;
+    if (lstat(socket_path, &st) == 0){ // 이전 실행이 남긴 socket 만 지움, 일반 파일 등은 덮어쓰지 않음
+        if (!S_ISSOCK(st.st_mode)){
+            printf("Error opening socket.\n");
+            return 1;
+        }
+        unlink(socket_path);
+    }
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *) &addr, sizeof(addr)) < 0 || listen(listen_fd, SERVER_MAX_CLIENTS) < 0){
+        printf("Error opening socket.\n");
+        return 1;
+    }
+
+    struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+    Connection clients[SERVER_MAX_CLIENTS + 1];
+    int num_fds = 1, running = 1;
+    fds[0].fd = listen_fd;
+    fds[0].events = POLLIN;
+
+    while (running){
+        if (poll(fds, num_fds, -1) < 0)
+            continue;
+
+        if ((fds[0].revents & POLLIN) && num_fds <= SERVER_MAX_CLIENTS){ // 새 연결
+            int fd = accept(listen_fd, NULL, NULL);
+            if (fd >= 0){ // 응답을 읽지 않는 연결 하나가 서버 전체를 막지 않도록 non-blocking
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                fds[num_fds].fd = fd;
+                fds[num_fds].events = POLLIN;
+                fds[num_fds].revents = 0;
+                clients[num_fds] = (Connection) { fd, fd, NULL, 0, 0, { NULL, 0, 0 }, 0, 0, 0 };
+                num_fds++;
+            }
+            if (num_fds > SERVER_MAX_CLIENTS) // 가득 차면 연결이 닫힐 때까지 listen fd 를 poll 하지 않음 (대기 중인 연결 때문에 poll 이 계속 깨어나는 것 방지)
+                fds[0].events = 0;
+        }
+
+        for (int i = 1; i < num_fds; ++i){
+            Connection *c = &clients[i];
+            if (!(fds[i].revents & (POLLIN | POLLOUT | POLLHUP | POLLERR)))
+                continue;
+            int status;
+            if (c->closing || c->sent < c->pending.length) // 밀린 응답부터 보냄
+                status = connectionFlush(c) != 0 ? SERVE_CLOSE : SERVE_CONTINUE;
+            else
+                status = connectionRead(c, handler, context);
+            if (status == SERVE_SHUTDOWN)
+                running = 0;
+            if (status != SERVE_CONTINUE)
+                c->closing = 1;
+            fds[i].events = c->sent < c->pending.length ? POLLOUT : POLLIN;
+
+            if (c->closing && c->sent == c->pending.length){ // 마지막 연결을 빈 자리로 옮기고 다시 검사
+                connectionFree(c);
+                fds[i] = fds[num_fds - 1];
+                clients[i] = clients[num_fds - 1];
+                num_fds--;
+                i--;
+                fds[0].events = POLLIN;
+            }
+        }
+    }
+
+    for (int i = 1; i < num_fds; ++i){
+        connectionFlush(&clients[i]);
+        connectionFree(&clients[i]);
+    }
+    close(listen_fd);
+    unlink(socket_path);
+    return 0;
+}
+
+#endif
@@ -1,7 +1,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <Kernel/stdbool.h> // 필요한 헤더파일 선언
+#include <stdbool.h>
+#include "server.h" // 필요한 헤더파일 선언
 #define CAPACITY 1000000 // 공간 지정
 
 typedef struct Node{ // 구조체 정의
@@ -58,6 +59,11 @@ int top(Stack *stack){ // time complexity = O(1), 가장 상단의 요소 꺼내
     return stack->top->element;
 }
 
+void clearStack(Stack *stack){ // time complexity = O(n), 남은 노드 모두 해제
+    while (!isEmpty(stack))
+        pop(stack);
+}
+
 int isPalindrome(Stack *stack, char word[], int length){ // time complexity = O(n), 펠린드롬 수 여부 체크
     int i;
     for (i=0; i<length/2; i++)
@@ -66,8 +72,11 @@ int isPalindrome(Stack *stack, char word[], int length){ // time complexity = O(
         i++;
     while (i < length){
         char character = pop(stack);
-        if (character != word[i])
+        if (character != word[i]){
+            for (i++; i < length; i++)
+                pop(stack); // 넣었던 글자를 모두 꺼내서 기존 스택 내용을 보존
             return 0;
+        }
         i++;
     }
     return 1;
@@ -91,17 +100,77 @@ int isBalanced(char exp[], int length) {
             push(stack, exp[i]);
         } else if (exp[i] == ')' || exp[i] == ']' || exp[i] == '}') {
             if (isEmpty(stack) || !isMatched(pop(stack), exp[i])) {
+                clearStack(stack);
                 free(stack);
                 return 0;
             }
         }
     }
     int result = isEmpty(stack); // 스택이 비어있으면 1, 아니면 0
+    clearStack(stack);
     free(stack);
     return result;
 }
 
+typedef struct StackServer{
+    Stack stack;
+    int size;
+} StackServer;
+
+void handleRequest(void *context, char *line, Reply *reply){ // 서버 요청 처리: PUSH x, POP, TOP, SIZE, PAL word, BAL expr
+    StackServer *server = (StackServer*) context;
+    char command[16];
+    int value, offset = 0;
+    if (sscanf(line, "%15s%n", command, &offset) != 1){
+        replyPrintf(reply, "ERR %s\n", line);
+        return;
+    }
+    char *argument = line + offset;
+    while (*argument == ' ' || *argument == '\t')
+        argument++;
+
+    if (strcmp(command, "PUSH") == 0 && sscanf(argument, "%d", &value) == 1){
+        if (push(&server->stack, value) == -1){
+            replyPrintf(reply, "Overflow\n");
+        } else{
+            server->size++;
+            replyPrintf(reply, "OK\n");
+        }
+    } else if (strcmp(command, "POP") == 0 || strcmp(command, "TOP") == 0){
+        if (isEmpty(&server->stack)){ // pop, top 의 터미널 출력이 응답과 섞이지 않도록 먼저 검사
+            replyPrintf(reply, "Underflow\n");
+        } else if (command[0] == 'P'){
+            server->size--;
+            replyPrintf(reply, "%d\n", pop(&server->stack));
+        } else{
+            replyPrintf(reply, "%d\n", top(&server->stack));
+        }
+    } else if (strcmp(command, "SIZE") == 0){
+        replyPrintf(reply, "%d\n", server->size);
+    } else if (strcmp(command, "PAL") == 0){
+        Stack* stack = createStack(); // 서버의 스택과 분리된 임시 스택
+        replyPrintf(reply, isPalindrome(stack, argument, strlen(argument)) ? "T\n" : "F\n");
+        clearStack(stack);
+        free(stack);
+    } else if (strcmp(command, "BAL") == 0){
+        replyPrintf(reply, isBalanced(argument, strlen(argument)) ? "T\n" : "F\n");
+    } else{
+        replyPrintf(reply, "ERR %s\n", line);
+    }
+}
+
 int main(int argc, char *argv[]){ // time complexity = O(n), main 함수
+    if (argc >= 2 && strcmp(argv[1], "-serve") == 0){ // 서버 모드: 스택 하나를 유지하면서 stdin 또는 socket 으로 요청 처리
+        StackServer server = { { NULL }, 0 };
+        int status = serve(argc >= 3 ? argv[2] : NULL, handleRequest, &server);
+        clearStack(&server.stack);
+        return status;
+    }
+    if (argc != 3){ // 예외 처리
+        printf("Usage: %s input.txt output.txt\n       %s -serve [socket]\n", argv[0], argv[0]);
+        return 1;
+    }
+
     Stack stack;
     stack.top = NULL;
 